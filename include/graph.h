@@ -65,6 +65,11 @@ public:
     }
     // Retorna o complemento do grafo atual
     Graph complement() const;
+    /*
+        Retorna uma cópia do grafo com os vértices renomeados segundo a ordem dada: o vértice order[i]
+        do grafo atual passa a ser o vértice i. As listas de vizinhos são ordenadas de forma crescente
+    */
+    Graph relabeled(const vector<int>& order) const;
 private:
 
     vector<Vertex> vertexes_;
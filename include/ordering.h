@@ -0,0 +1,27 @@
+#ifndef ORDERING_H
+#define ORDERING_H
+#include <vector>
+#include "graph.h"
+#include "utility.h"
+
+using std::vector;
+
+/*
+    Calcula uma nova ordem para os vértices do grafo, segundo a estratégia dada. O vetor retornado
+    contém os identificadores originais dos vértices na ordem em que devem aparecer no grafo
+    reordenado, isto é, o vértice order[i] passa a ter o identificador i. As estratégias disponíveis são:
+    - degree: vértices em ordem decrescente de grau
+    - rcm: Reverse Cuthill-McKee, isto é, uma busca em largura a partir do vértice de menor grau de cada
+      componente, visitando os vizinhos em ordem crescente de grau, com a ordem final invertida
+    - community: vértices agrupados pelas comunidades encontradas por propagação de rótulos
+*/
+vector<int> vertex_ordering(const Graph& graph, Orderings ordering);
+
+/*
+    Reordena os vértices da instância dada segundo a estratégia informada, de forma que vértices vizinhos
+    fiquem próximos na memória. Retorna o vetor com a ordem utilizada (ver "vertex_ordering"), que permite
+    traduzir os identificadores do grafo reordenado de volta para os identificadores originais.
+*/
+vector<int> reorder_instance(InstanceInfo& instance, Orderings ordering);
+
+#endif
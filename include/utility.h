@@ -2,15 +2,19 @@
 #define UTILITY_H
 #include <string>
 #include "graph.h"
+#include "workspace.h"
 #define MIN_EXPECTED_ARGS 2
 
 using std::string;
 
 enum class Strategies { list_right, grasp_deg, grasp_weideg };
 
+enum class Orderings { none, degree, rcm, community };
+
 struct Arguments {
     string input_path, instance_name;
     Strategies algorithm;
+    Orderings ordering;
     double alpha;
     int reps;
 };
@@ -32,17 +36,30 @@ double mean(const vector<double>& data);
 
 double deviation(const vector<double>& data);
 
-void print_results(const Arguments& args, const InstanceInfo& instance, const vector<double>& results);
+/*
+    Imprime os resultados obtidos. Os tempos de reordenação dos vértices (reorder_time) e de execução do
+    algoritmo (solve_time) são dados em segundos.
+*/
+void print_results(const Arguments& args, const InstanceInfo& instance, const vector<double>& results, double reorder_time, double solve_time);
 
 /*
     Essa função amostra os resultados da execução do GRASP, executando a função (f) dada como parâmetro,
-    que deve retornar um inteiro e receber, como parâmetro, os dados da instância e um real com o valor,
-    do parâmetro alpha, isto é, a assinatura da função deve ser int f(const InstanceInfo&, double). A 
-    função f é executada pelo número de vezes especificado pelo inteiro positivo (reps) e os resultados 
-    retornados são convertidos para reais (double) e armazenados em um vetor, que é retornado como 
-    resultado.
+    que deve retornar um inteiro e receber, como parâmetro, os dados da instância, um real com o valor
+    do parâmetro alpha e o espaço de trabalho (Workspace) a ser reutilizado, isto é, a assinatura da 
+    função deve ser int f(const InstanceInfo&, double, Workspace&). O espaço de trabalho é criado uma
+    única vez, antes das repetições. A função f é executada pelo número de vezes especificado pelo 
+    inteiro positivo (reps) e os resultados retornados são convertidos para reais (double) e armazenados
+    em um vetor, que é retornado como resultado.
+*/
+vector<double> sample_results(int reps, int(*f)(const InstanceInfo&, double, Workspace&), const InstanceInfo& instance, double alpha);
+
+#ifdef MVC_COUNT_ALLOCS
+/*
+    Retorna o número de alocações dinâmicas (chamadas ao operador new) realizadas desde o início da
+    execução. Disponível apenas quando o programa é compilado com a flag MVC_COUNT_ALLOCS.
 */
-vector<double> sample_results(int reps, int(*f)(const InstanceInfo&, double), const InstanceInfo& instance, double alpha);
+size_t allocation_count();
+#endif
 
 
 #endif
\ No newline at end of file
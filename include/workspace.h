@@ -0,0 +1,43 @@
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+#include <vector>
+#include "graph.h"
+
+using std::vector;
+
+/*
+    A classe Workspace agrupa os vetores auxiliares utilizados pelas heurísticas construtivas e pela
+    busca local. Ela deve ser criada uma única vez por linha de execução (antes das repetições do GRASP)
+    e reiniciada com "reset" no início de cada construção. Como todos os vetores são dimensionados no
+    construtor e "reset" apenas sobrescreve seus valores, nenhuma alocação dinâmica é feita por repetição.
+*/
+class Workspace {
+public:
+    inline Workspace(size_t num_vertexes) : in_vc(num_vertexes, false), new_in_vc(num_vertexes, false),
+        seen(num_vertexes, false), deg(num_vertexes, 0), weideg(num_vertexes, 0) {
+        candidates.reserve(num_vertexes);
+    }
+
+    // Reinicia a cobertura e os graus residuais a partir do grafo dado, sem realocar os vetores
+    inline void reset(const Graph& graph) {
+        int num_vertexes = graph.num_vertexes();
+        in_vc.assign(num_vertexes, false);
+        seen.assign(num_vertexes, false);
+        for(int v = 0; v < num_vertexes; v++)
+            deg[v] = graph[v].degree();
+        candidates.clear();
+    }
+
+    // Vértices na cobertura atual e cópia usada pela busca local para avaliar trocas
+    vector<bool> in_vc, new_in_vc;
+    // Vértices já visitados (utilizado pelo List Right)
+    vector<bool> seen;
+    // Grau residual de cada vértice (número de arestas incidentes ainda não cobertas)
+    vector<int> deg;
+    // Lista de candidatos da iteração atual da construção
+    vector<int> candidates;
+    // Valor da heurística WEIDEG para cada vértice
+    vector<double> weideg;
+};
+
+#endif
@@ -1,6 +1,8 @@
 #include "../include/graph.h"
 #include <stack>
 #include <list>
+#include <algorithm>
+#include <stdexcept>
 
 using std::stack;
 using std::list;
@@ -125,3 +127,25 @@ Graph Graph::complement() const  {
     }
     return complement;
 }
+
+Graph Graph::relabeled(const vector<int>& order) const {
+    size_t n = vertexes_.size();
+    if(order.size() != n)
+        throw std::invalid_argument("A ordem fornecida para renomear os vértices não possui o mesmo tamanho do grafo!");
+    vector<int> new_id(n, -1), r_neighbors;
+    Graph relabeled;
+    for(size_t i = 0; i < n; i++) {
+        if(order[i] < 0 || order[i] >= static_cast<int>(n) || new_id[order[i]] != -1)
+            throw std::invalid_argument("A ordem fornecida para renomear os vértices não é uma permutação válida!");
+        new_id[order[i]] = i;
+    }
+    relabeled.vertexes_.reserve(n);
+    for(size_t i = 0; i < n; i++) {
+        for(int j : vertexes_[order[i]].neighbors())
+            r_neighbors.emplace_back(new_id[j]);
+        std::sort(r_neighbors.begin(), r_neighbors.end());
+        relabeled.vertexes_.emplace_back(i, r_neighbors);
+        r_neighbors.clear();
+    }
+    return relabeled;
+}
@@ -9,6 +9,8 @@
 #include <chrono>
 #include "../include/graph.h"
 #include "../include/utility.h"
+#include "../include/workspace.h"
+#include "../include/ordering.h"
 
 using namespace std;
 
@@ -22,70 +24,83 @@ int uniform(int l, int r){
 }
 
 // O(V.log(V) + E)
-int lr(const InstanceInfo& instance) {
-    vector<bool> seen(instance.num_vertexes, false), in_vc(instance.num_vertexes, false);
-    vector<int> L(instance.num_vertexes);
+int lr(const InstanceInfo& instance, Workspace& ws) {
+    ws.reset(instance.graph);
+    vector<int>& L = ws.candidates;
+    L.resize(instance.num_vertexes);
     iota(L.begin(), L.end(), 0);
     stable_sort(L.rbegin(), L.rend(), [&] (int u, int v) {
         return instance.graph[u].degree() < instance.graph[v].degree();
     });
     for(int u = instance.num_vertexes - 1; u >= 0; u--) {
-        for(const Vertex& v : instance.graph[u].neighbors()) {
-            if(seen[v.id()] and not in_vc[v.id()]) {
-                in_vc[u] = true;
+        for(int v : instance.graph[u].neighbors()) {
+            if(ws.seen[v] and not ws.in_vc[v]) {
+                ws.in_vc[u] = true;
                 break;
             }
         }
-        seen[u] = true;
+        ws.seen[u] = true;
     }
-    return accumulate(in_vc.begin(), in_vc.end(), int(0));
+    return accumulate(ws.in_vc.begin(), ws.in_vc.end(), int(0));
 }
 
 // O(V^4) - caso patológico, na prática deve rodar muito mais rápido
-int local_search_ma(const InstanceInfo& instance, vector<bool> in_vc) {
-    int cur_vc_sz = accumulate(in_vc.begin(), in_vc.end(), int(0));
+// A busca parte da cobertura em ws.in_vc e, a cada melhoria, troca ws.in_vc por ws.new_in_vc e recomeça
+int local_search_ma(const InstanceInfo& instance, Workspace& ws) {
+    int cur_vc_sz = accumulate(ws.in_vc.begin(), ws.in_vc.end(), int(0));
     for(int v = 0; v < static_cast<int>(instance.num_vertexes); v++) {
-        if(not in_vc[v]) {
+        if(not ws.in_vc[v]) {
             bool can_replace = true;
-            for(const Vertex& u : instance.graph[v].neighbors()) {
-                if(not in_vc[u.id()]) {
+            for(int u : instance.graph[v].neighbors()) {
+                if(not ws.in_vc[u]) {
                     can_replace = false;
                     break;
                 }
             }
             if(can_replace) {
-                vector<bool> new_in_vc(in_vc);
+                vector<bool>& new_in_vc = ws.new_in_vc;
+                new_in_vc = ws.in_vc;
                 new_in_vc[v] = true;
-                for(const Vertex& u : instance.graph[v].neighbors()) {
+                for(int u : instance.graph[v].neighbors()) {
                     bool still_needed = false;
-                    for(const Vertex& w : instance.graph[u.id()].neighbors()) 
-                        if(not new_in_vc[w.id()])
+                    for(int w : instance.graph[u].neighbors()) 
+                        if(not new_in_vc[w])
                         still_needed = true;
-                    new_in_vc[u.id()] = still_needed;
+                    new_in_vc[u] = still_needed;
+                }
+                int new_vc_sz = accumulate(new_in_vc.begin(), new_in_vc.end(), int(0));
+                if(new_vc_sz < cur_vc_sz) {
+                    ws.in_vc.swap(new_in_vc);
+                    cur_vc_sz = new_vc_sz;
+                    v = -1;
                 }
-                if(accumulate(new_in_vc.begin(), new_in_vc.end(), int(0)) < cur_vc_sz)
-                    return local_search_ma(instance, new_in_vc);
             }
         }
     }
     return cur_vc_sz;
 }
 
+/*
+    As listas de candidatos são ordenadas com std::sort (que não aloca memória, ao contrário de
+    std::stable_sort), desempatando pelo índice do vértice. Como a lista é montada em ordem crescente
+    de índice, a ordem resultante é a mesma que a da ordenação estável decrescente.
+*/
+
 // O(V^2.log(V) + local_search_ma)
-int grasp_deg(const InstanceInfo& instance, double alpha) {
+int grasp_deg(const InstanceInfo& instance, double alpha, Workspace& ws) {
     int to_cover = instance.num_edges;
-    vector<bool> in_vc(instance.num_vertexes, false);
-    vector<int> deg(instance.num_vertexes);
-    for(int v = 0; v < static_cast<int>(instance.num_vertexes); v++)
-        deg[v] = instance.graph[v].degree();
+    ws.reset(instance.graph);
+    vector<bool>& in_vc = ws.in_vc;
+    vector<int>& deg = ws.deg;
+    vector<int>& L = ws.candidates;
     // O(V^2.log_2(V)))
     while(to_cover > 0) {
-        vector<int> L;
+        L.clear();
         for(int v = 0; v < static_cast<int>(instance.num_vertexes); v++)
             if(not in_vc[v] and deg[v] > 0)
                 L.emplace_back(v);
-        stable_sort(L.rbegin(), L.rend(), [&] (int u, int v) {
-            return deg[u] < deg[v];
+        sort(L.begin(), L.end(), [&] (int u, int v) {
+            return deg[u] != deg[v] ? deg[u] > deg[v] : u < v;
         });
         int c_min = deg[L.back()], c_max = deg[L.front()], l = 0;
         // Já que estamos maximizando deg, alpha = 1 é guloso e 0 é totalmente aleatório
@@ -93,39 +108,41 @@ int grasp_deg(const InstanceInfo& instance, double alpha) {
             l++;
         assert(l > 0);
         int v = L[uniform(0, l - 1)];
-        for(const Vertex& u : instance.graph[v].neighbors())
-            if(not in_vc[u.id()])
-                to_cover--, deg[u.id()]--, deg[v]--;
+        for(int u : instance.graph[v].neighbors())
+            if(not in_vc[u])
+                to_cover--, deg[u]--, deg[v]--;
         assert(deg[v] == 0);
         in_vc[v] = true;
     }
 
-    return local_search_ma(instance, in_vc);
+    return local_search_ma(instance, ws);
 }
 
 // O(V^3 + local_search_ma)
-int grasp_weideg(const InstanceInfo& instance, double alpha) {
+int grasp_weideg(const InstanceInfo& instance, double alpha, Workspace& ws) {
     int to_cover = instance.num_edges;
-    vector<bool> in_vc(instance.num_vertexes, false);
-    vector<int> deg(instance.num_vertexes);
-    for(int v = 0; v < static_cast<int>(instance.num_vertexes); v++)
-        deg[v] = instance.graph[v].degree();
+    ws.reset(instance.graph);
+    vector<bool>& in_vc = ws.in_vc;
+    vector<int>& deg = ws.deg;
+    vector<int>& L = ws.candidates;
+    vector<double>& weideg = ws.weideg;
     // O(V^3)
     while(to_cover > 0) {
-        vector<int> L;
-        vector<double> weideg(instance.num_vertexes);
+        L.clear();
         for(int v = 0; v < static_cast<int>(instance.num_vertexes); v++) {
             if(not in_vc[v] and deg[v] > 0) {
                 L.emplace_back(v);
                 weideg[v] = deg[v];
                 double sum_neighbors_deg = 0;
-                for(const Vertex& u : instance.graph[v].neighbors())
-                    sum_neighbors_deg += deg[u.id()];
+                for(int u : instance.graph[v].neighbors())
+                    sum_neighbors_deg += deg[u];
                 weideg[v] /= sum_neighbors_deg;
             }
         }
-        stable_sort(L.rbegin(), L.rend(), [&] (int u, int v) {
-            return weideg[u] != weideg[v] ? weideg[u] < weideg[v] : deg[u] < deg[v];
+        sort(L.begin(), L.end(), [&] (int u, int v) {
+            if(weideg[u] != weideg[v])
+                return weideg[u] > weideg[v];
+            return deg[u] != deg[v] ? deg[u] > deg[v] : u < v;
         });
         double c_min = weideg[L.back()], c_max = weideg[L.front()];
         int l = 0;
@@ -134,14 +151,14 @@ int grasp_weideg(const InstanceInfo& instance, double alpha) {
             l++;
         assert(l > 0);
         int v = L[uniform(0, l - 1)];
-        for(const Vertex& u : instance.graph[v].neighbors())
-            if(not in_vc[u.id()])
-                to_cover--, deg[u.id()]--, deg[v]--;
+        for(int u : instance.graph[v].neighbors())
+            if(not in_vc[u])
+                to_cover--, deg[u]--, deg[v]--;
         assert(deg[v] == 0);
         in_vc[v] = true;
     }
 
-    return local_search_ma(instance, in_vc);
+    return local_search_ma(instance, ws);
 }
 
 int main(int argc, char* argv[]) {
@@ -150,13 +167,27 @@ int main(int argc, char* argv[]) {
         Arguments args = parse_arguments(argc, argv);
         validate_arguments(args);
         InstanceInfo instance = parse_input_file(args.input_path);
+        /*
+            O tamanho da cobertura não depende dos identificadores dos vértices, logo a ordem retornada
+            (que mapeia os novos identificadores para os originais) só seria necessária para exportar a
+            cobertura em si
+        */
+        auto reorder_start = chrono::steady_clock::now();
+        reorder_instance(instance, args.ordering);
+        auto solve_start = chrono::steady_clock::now();
         switch(args.algorithm) {
-            case Strategies::list_right: results = { static_cast<double>(lr(instance)) }; break;
+            case Strategies::list_right: {
+                Workspace ws(instance.num_vertexes);
+                results = { static_cast<double>(lr(instance, ws)) };
+                break;
+            }
             case Strategies::grasp_deg: results = sample_results(args.reps, grasp_deg, instance, args.alpha); break;
             case Strategies::grasp_weideg: results = sample_results(args.reps, grasp_weideg, instance, args.alpha); break;
             default: results = {};
         }
-        print_results(args, instance, results);
+        auto solve_end = chrono::steady_clock::now();
+        print_results(args, instance, results, chrono::duration<double>(solve_start - reorder_start).count(),
+            chrono::duration<double>(solve_end - solve_start).count());
     }catch(std::exception& e) {
         cout << "Erro: " << e.what() << endl;
     }
@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include "../include/ordering.h"
+#define MAX_PROPAGATION_ROUNDS 10
+
+using std::queue;
+using std::iota;
+using std::stable_sort;
+using std::reverse;
+
+// O(V.log(V))
+vector<int> degree_ordering(const Graph& graph) {
+    vector<int> order(graph.num_vertexes());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&] (int u, int v) {
+        return graph[u].degree() > graph[v].degree();
+    });
+    return order;
+}
+
+// O(V + E.log(V))
+vector<int> rcm_ordering(const Graph& graph) {
+    int num_vertexes = graph.num_vertexes();
+    vector<bool> visited(num_vertexes, false);
+    vector<int> order, by_degree(num_vertexes), neighbors;
+    queue<int> to_visit;
+    order.reserve(num_vertexes);
+    iota(by_degree.begin(), by_degree.end(), 0);
+    stable_sort(by_degree.begin(), by_degree.end(), [&] (int u, int v) {
+        return graph[u].degree() < graph[v].degree();
+    });
+    // Cada componente é percorrida a partir do vértice não visitado de menor grau
+    for(int root : by_degree) {
+        if(visited[root])
+            continue;
+        visited[root] = true;
+        to_visit.push(root);
+        while(not to_visit.empty()) {
+            int u = to_visit.front();
+            to_visit.pop();
+            order.emplace_back(u);
+            neighbors.clear();
+            for(int v : graph[u].neighbors())
+                if(not visited[v])
+                    neighbors.emplace_back(v);
+            stable_sort(neighbors.begin(), neighbors.end(), [&] (int v, int w) {
+                return graph[v].degree() < graph[w].degree();
+            });
+            for(int v : neighbors) {
+                visited[v] = true;
+                to_visit.push(v);
+            }
+        }
+    }
+    reverse(order.begin(), order.end());
+    return order;
+}
+
+// O(MAX_PROPAGATION_ROUNDS.(V + E) + V.log(V))
+vector<int> community_ordering(const Graph& graph) {
+    int num_vertexes = graph.num_vertexes();
+    vector<int> label(num_vertexes), frequency(num_vertexes, 0), touched, order(num_vertexes);
+    iota(label.begin(), label.end(), 0);
+    /*
+        Propagação de rótulos: cada vértice assume o rótulo mais frequente entre seus vizinhos (em caso
+        de empate, o menor rótulo), até que nenhum rótulo mude ou o limite de rodadas seja atingido
+    */
+    bool changed = true;
+    for(int round = 0; round < MAX_PROPAGATION_ROUNDS and changed; round++) {
+        changed = false;
+        for(int u = 0; u < num_vertexes; u++) {
+            if(graph[u].degree() == 0)
+                continue;
+            int best_label = label[u], best_frequency = 0;
+            for(int v : graph[u].neighbors()) {
+                if(frequency[label[v]]++ == 0)
+                    touched.emplace_back(label[v]);
+            }
+            for(int l : touched) {
+                if(frequency[l] > best_frequency or (frequency[l] == best_frequency and l < best_label))
+                    best_label = l, best_frequency = frequency[l];
+                frequency[l] = 0;
+            }
+            touched.clear();
+            if(best_label != label[u]) {
+                label[u] = best_label;
+                changed = true;
+            }
+        }
+    }
+    // Os vértices são agrupados por comunidade, mantendo a ordem original dentro de cada uma
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&] (int u, int v) {
+        return label[u] < label[v];
+    });
+    return order;
+}
+
+vector<int> vertex_ordering(const Graph& graph, Orderings ordering) {
+    switch(ordering) {
+        case Orderings::degree: return degree_ordering(graph);
+        case Orderings::rcm: return rcm_ordering(graph);
+        case Orderings::community: return community_ordering(graph);
+        default: break;
+    }
+    vector<int> order(graph.num_vertexes());
+    iota(order.begin(), order.end(), 0);
+    return order;
+}
+
+vector<int> reorder_instance(InstanceInfo& instance, Orderings ordering) {
+    vector<int> order = vertex_ordering(instance.graph, ordering);
+    if(ordering != Orderings::none)
+        instance.graph = instance.graph.relabeled(order);
+    return order;
+}
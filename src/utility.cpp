@@ -4,6 +4,8 @@
 #include <cmath>
 #include <iostream>
 #include <algorithm>
+#include <new>
+#include <cstdlib>
 #include "../include/utility.h"
 #define MAX_REPS 100000
 
@@ -31,6 +33,32 @@ Strategies strategy_from_str(const char* str) {
     throw std::runtime_error("Estratégia \""s + str + "\" não reconhecida!\nAs estratégias (algoritmos) disponíveis são: List Right (lr), GRASP DEG (gd), GRASP WEIDEG (gw)");
 }
 
+Orderings ordering_from_str(const char* str) {
+    string input(str);
+    for(char& c : input)
+        c = tolower(c);
+    if(input == "none") {
+        return Orderings::none;
+    }else if(input == "deg") {
+        return Orderings::degree;
+    }else if(input == "rcm") {
+        return Orderings::rcm;
+    }else if(input == "comm") {
+        return Orderings::community;
+    }
+    throw std::runtime_error("Ordenação \""s + str + "\" não reconhecida!\nAs ordenações de vértices disponíveis são: nenhuma (none), por grau (deg), Reverse Cuthill-McKee (rcm), por comunidades (comm)");
+}
+
+const char* ordering_name(Orderings o) {
+    switch(o) {
+    case Orderings::none: return "Nenhuma (ordem do arquivo de entrada)";
+    case Orderings::degree: return "Grau decrescente";
+    case Orderings::rcm: return "Reverse Cuthill-McKee";
+    case Orderings::community: return "Agrupamento por comunidades (propagação de rótulos)";
+    }
+    return "";
+}
+
 const char* strategy_name(Strategies s) {
     switch(s) {
     case Strategies::list_right: return "List Right";
@@ -43,9 +71,10 @@ const char* strategy_name(Strategies s) {
 Arguments parse_arguments(int argc, char** argv) {
     Arguments args;
     string instance_name;
-    // Definindo valores padrão para os argumentos alpha e reps
+    // Definindo valores padrão para os argumentos alpha, reps e ordering
     args.alpha = 0;
     args.reps = 1;
+    args.ordering = Orderings::none;
     if(argc < MIN_EXPECTED_ARGS + 1) 
         throw std::runtime_error("O número de argumentos fornecidos não é suficiente.");
     for(int i = 1; i < argc; i++) {
@@ -57,6 +86,7 @@ Arguments parse_arguments(int argc, char** argv) {
                 case 's': args.algorithm = strategy_from_str(argv[i + 1]); break;
                 case 'a': args.alpha = atof(argv[i + 1]); break;
                 case 'r': args.reps = atoi(argv[i + 1]); break;
+                case 'o': args.ordering = ordering_from_str(argv[i + 1]); break;
                 default: throw std::runtime_error("Modificador "s + argv[i] + " não reconhecido.");
             }
             i++;
@@ -194,7 +224,7 @@ double deviation(const vector<double>& data) {
     return sqrt(var);
 }
 
-void print_results(const Arguments& args, const InstanceInfo& instance, const vector<double>& results) {
+void print_results(const Arguments& args, const InstanceInfo& instance, const vector<double>& results, double reorder_time, double solve_time) {
     const double mu = mean(results), sigma = deviation(results);
     const bool is_random = args.algorithm != Strategies::list_right;
 
@@ -202,6 +232,7 @@ void print_results(const Arguments& args, const InstanceInfo& instance, const ve
     cout << "Número de vértices: " << instance.num_vertexes << endl;
     cout << "Número de arestas: " << instance.num_edges << endl;
     cout << "Heurística utilizada: " << strategy_name(args.algorithm) << endl;
+    cout << "Ordenação dos vértices: " << ordering_name(args.ordering) << endl;
     if(is_random) {
         cout << "Valor do parâmetro (alpha) utilizado: " << args.alpha << endl;
         cout << "Número de execuções do algoritmo: " << args.reps << endl;
@@ -211,12 +242,64 @@ void print_results(const Arguments& args, const InstanceInfo& instance, const ve
         cout << "Tamanho da menor cobertura encontrada: " << *min_element(results.begin(), results.end()) << endl;
         cout << "Desvio padrão das coberturas encontradas: " << sigma << endl;
     }
+    cout << "Tempo de reordenação dos vértices (s): " << reorder_time << endl;
+    cout << "Tempo de execução do algoritmo (s): " << solve_time << endl;
 }
 
-vector<double> sample_results(int reps, int(*f)(const InstanceInfo&, double), const InstanceInfo& instance, double alpha) {
+vector<double> sample_results(int reps, int(*f)(const InstanceInfo&, double, Workspace&), const InstanceInfo& instance, double alpha) {
     vector<double> results;
+    Workspace ws(instance.num_vertexes);
     results.reserve(reps);
+#ifdef MVC_COUNT_ALLOCS
+    size_t max_allocs = 0, total_allocs = 0;
+    for(int i = 0; i < reps; i++) {
+        size_t allocs_before = allocation_count();
+        results.emplace_back(static_cast<double>(f(instance, alpha, ws)));
+        size_t allocs = allocation_count() - allocs_before;
+        max_allocs = std::max(max_allocs, allocs);
+        total_allocs += allocs;
+    }
+    std::cerr << "Alocações por repetição (média): " << static_cast<double>(total_allocs) / reps << endl;
+    std::cerr << "Alocações por repetição (máximo): " << max_allocs << endl;
+#else
     for(int i = 0; i < reps; i++)
-        results.emplace_back(static_cast<double>(f(instance, alpha)));
+        results.emplace_back(static_cast<double>(f(instance, alpha, ws)));
+#endif
     return results;
 }
+
+#ifdef MVC_COUNT_ALLOCS
+// Contador global de alocações, incrementado pelas substituições dos operadores new abaixo
+static size_t num_allocations = 0;
+
+size_t allocation_count() {
+    return num_allocations;
+}
+
+void* operator new(size_t size) {
+    num_allocations++;
+    if(void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    std::free(ptr);
+}
+#endif